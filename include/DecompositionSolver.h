@@ -0,0 +1,84 @@
+#ifndef DECOMPOSITIONSOLVER_H
+#define DECOMPOSITIONSOLVER_H
+
+#include <vector>
+#include <string>
+#include "Solver.h"
+
+// Декомпозиция Данцига-Вулфа для задач блочной структуры:
+// независимые блоки связаны небольшим числом общих ограничений
+class DecompositionSolver {
+public:
+    struct Block {
+        std::vector<int> variables;                   // Глобальные индексы переменных блока
+        std::vector<Solver::Constraint> constraints;  // Ограничения блока (локальные индексы)
+    };
+
+    struct BlockModel {
+        std::vector<double> objective;                // Целевая функция по всем переменным
+        std::vector<Solver::Constraint> linking;      // Связывающие ограничения (глобальные индексы)
+        std::vector<Block> blocks;
+        bool maximize = true;
+    };
+
+    // Параметры декомпозиции (значение 0 - вычислить по размеру задачи)
+    struct Options {
+        int maxRounds = 0;               // Лимит решений мастер-задачи
+        int threads = 0;                 // Потоки для подзадач (0 - по числу ядер)
+        double tolerance = 1e-7;         // Порог приведенной стоимости нового столбца
+        bool verbose = true;
+    };
+
+    struct Result {
+        Solver::Status status = Solver::Status::ITERATION_LIMIT;
+        std::vector<double> solution;
+        double objectiveValue = 0.0;
+        int masterRounds = 0;            // Решений мастер-задачи
+        int masterIterations = 0;        // Симплекс-итерации мастер-задачи
+        int subproblemIterations = 0;    // Симплекс-итерации всех подзадач
+        int columnsGenerated = 0;
+        double elapsedSeconds = 0.0;
+        double pricingSeconds = 0.0;     // Время параллельного решения подзадач
+        bool monolithicFallback = false; // Подзадача не ограничена - решено одной таблицей
+        int monolithicIterations = 0;
+    };
+
+    static Result solve(const BlockModel& model, const Options& options);
+    static Result solve(const BlockModel& model);
+
+    // Поиск блочной структуры: связывающими становятся строки, задевающие больше
+    // всего других строк, пока переменные не распадутся на компоненты, в каждой из
+    // которых есть свои строки; если такого разбиения нет среди нескольких первых
+    // кандидатов (не больше десятой части строк), возвращается один блок
+    static BlockModel detectBlocks(
+        const std::vector<double>& objective,
+        const std::vector<Solver::Constraint>& constraints,
+        bool maximize = true
+    );
+
+    // Та же задача одной симплекс-таблицей
+    static std::vector<Solver::Constraint> toMonolithic(const BlockModel& model);
+
+    static void printComparison(const Result& decomposition, const Solver::Result& monolithic);
+
+private:
+    struct Column {
+        int block;
+        std::vector<double> point;       // Крайняя точка подзадачи (локальные индексы)
+        double cost;
+        std::vector<double> linkingCoefficients;
+    };
+
+    struct BlockState {
+        std::vector<int> basis;          // Базис предыдущего решения подзадачи
+        Solver::Result last;
+    };
+
+    class WorkerPool;
+
+    static void priceBlocks(const BlockModel& model, const std::vector<double>& linkingDuals,
+                            std::vector<BlockState>& states, WorkerPool& pool);
+    static Column makeColumn(const BlockModel& model, int block, const std::vector<double>& point);
+};
+
+#endif
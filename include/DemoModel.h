@@ -0,0 +1,9 @@
+#ifndef DEMOMODEL_H
+#define DEMOMODEL_H
+
+#include "DecompositionSolver.h"
+
+// Несколько счетов демонстрационной задачи с общими лимитами по x и y
+DecompositionSolver::BlockModel createAccountsModel(int numAccounts);
+
+#endif
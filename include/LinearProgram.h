@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include "Solver.h"
 
 class LinearProgram {
 private:
@@ -37,6 +38,10 @@ public:
     double getMaxZ() const { return maxZ; }
     double getMaxValue() const { return maxValue; }
     
+    // Данные задачи в формате общего симплекс-метода
+    const std::vector<double>& getObjectiveCoefficients() const { return objectiveCoefficients; }
+    std::vector<Solver::Constraint> toSolverConstraints() const;
+    
     // Вспомогательные методы
     static LinearProgram createDemoProblem();
     
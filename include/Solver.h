@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <chrono>
 
 class Solver {
 public:
@@ -11,35 +12,110 @@ public:
         GREATER_EQUAL,
         EQUAL
     };
-    
+
+    // Статус завершения симплекс-метода
+    enum class Status {
+        OPTIMAL,          // Найдено оптимальное решение
+        INFEASIBLE,       // Искусственная переменная осталась в базисе
+        UNBOUNDED,        // Целевая функция не ограничена
+        ITERATION_LIMIT,  // Исчерпан лимит итераций
+        TIME_LIMIT        // Исчерпан лимит времени
+    };
+
     struct Constraint {
         std::vector<double> coefficients;
         double rhs;
         ConstraintType type;
         std::string name;
     };
-    
+
+    // Параметры симплекс-метода (значение 0 - вычислить по размеру задачи).
+    // Основная защита от зацикливания - лексикографический тест отношений;
+    // возмущение - крайняя мера при остановке дольше stallLimit итераций
+    // (по умолчанию max(10, число строк)), на типичных задачах не включается
+    struct Options {
+        int maxIterations = 0;
+        double timeLimitSeconds = 0.0;
+        int stallLimit = 0;              // Длина серии вырожденных итераций, считающейся остановкой
+        bool perturb = true;             // Возмущать задачу при остановке
+        double perturbationScale = 1e-7;
+        unsigned int seed = 12345;
+        bool verbose = true;
+        std::vector<int> initialBasis;   // Базис предыдущего решения (теплый старт)
+    };
+
+    struct Result {
+        Status status = Status::ITERATION_LIMIT;
+        std::vector<double> solution;
+        std::vector<double> duals;       // Двойственные оценки: d(Z)/d(rhs) для каждого ограничения
+        std::vector<int> basis;          // Базис по строкам таблицы (для теплого старта)
+        double objectiveValue = 0.0;
+        int iterations = 0;
+        int degenerateIterations = 0;    // Итерации с нулевым шагом
+        int stallSwitches = 0;           // Сколько раз включалось правило Бленда
+        bool perturbed = false;          // Применялось ли возмущение
+        int cleanupIterations = 0;       // Итерации после снятия возмущения
+        double elapsedSeconds = 0.0;
+    };
+
+    static Result solve(
+        const std::vector<double>& objective,
+        const std::vector<Constraint>& constraints,
+        bool maximize,
+        const Options& options
+    );
+
+    static Result solve(
+        const std::vector<double>& objective,
+        const std::vector<Constraint>& constraints,
+        bool maximize = true
+    );
+
     static std::vector<double> solveLinearProgram(
         const std::vector<double>& objective,
         const std::vector<Constraint>& constraints,
         bool maximize = true
     );
-    
-    static void printResults(const std::vector<double>& solution, 
+
+    static void printResults(const std::vector<double>& solution,
                             const std::vector<double>& objective);
-    
+
+    static std::string statusToString(Status status);
+
 private:
-    static std::vector<std::vector<double>> createTableau(
+    using Tableau = std::vector<std::vector<double>>;
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    static Tableau createTableau(
         const std::vector<double>& objective,
         const std::vector<Constraint>& constraints,
-        bool maximize
+        bool maximize,
+        std::vector<int>& basis
     );
-    
-    static int findPivotColumn(const std::vector<std::vector<double>>& tableau);
-    static int findPivotRow(const std::vector<std::vector<double>>& tableau, int pivotCol);
-    static void performPivot(std::vector<std::vector<double>>& tableau, 
-                           int pivotRow, int pivotCol);
-    static bool isOptimal(const std::vector<std::vector<double>>& tableau);
+
+    static Status iterate(Tableau& tableau, std::vector<int>& basis,
+                          const std::vector<int>& unitColumns,
+                          const Options& options, TimePoint start, Result& result,
+                          bool allowPerturbation);
+
+    static bool applyBasis(Tableau& tableau, std::vector<int>& basis,
+                           const std::vector<int>& target);
+    static void priceOutBasis(Tableau& tableau, const std::vector<int>& basis);
+    static void perturbProblem(Tableau& tableau, const std::vector<int>& basis,
+                               const Options& options);
+    static bool removePerturbation(Tableau& tableau, const std::vector<int>& basis,
+                                   const std::vector<int>& unitColumns,
+                                   const std::vector<double>& originalCosts,
+                                   const std::vector<double>& originalRHS);
+
+    static int findPivotColumn(const Tableau& tableau);
+    static int findPivotColumnBland(const Tableau& tableau);
+    static int findPivotRow(const Tableau& tableau, int pivotCol,
+                            const std::vector<int>& unitColumns);
+    static bool isLexicographicallySmaller(const Tableau& tableau, int rowA, int rowB,
+                                           int pivotCol, const std::vector<int>& unitColumns);
+    static void performPivot(Tableau& tableau, int pivotRow, int pivotCol);
+    static bool isOptimal(const Tableau& tableau);
 };
 
 #endif
\ No newline at end of file
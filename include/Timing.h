@@ -0,0 +1,11 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <chrono>
+
+// Время в секундах, прошедшее с момента start
+inline double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif
@@ -0,0 +1,562 @@
+#include "DecompositionSolver.h"
+#include "Timing.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+
+namespace {
+
+int findRoot(std::vector<int>& parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+} // namespace
+
+// Постоянные потоки для решения подзадач: создаются один раз на весь solve,
+// в каждом раунде получают новое задание вместо запуска новых std::thread
+class DecompositionSolver::WorkerPool {
+public:
+    explicit WorkerPool(int threads) {
+        for (int t = 1; t < threads; t++) {
+            workers.emplace_back([this]() { loop(); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Выполняет task(0), ..., task(count - 1); вызывающий поток тоже участвует
+    void run(int count, const std::function<void(int)>& task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = &task;
+            total = count;
+            next = 0;
+            active = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+        work();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]() { return active == 0; });
+        current = nullptr;
+    }
+
+private:
+    void loop() {
+        int seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+            work();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--active == 0) done.notify_one();
+            }
+        }
+    }
+
+    void work() {
+        for (int k = next++; k < total; k = next++) {
+            (*current)(k);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(int)>* current = nullptr;
+    int total = 0;
+    std::atomic<int> next{0};
+    int active = 0;
+    int generation = 0;
+    bool stopping = false;
+};
+
+DecompositionSolver::Result DecompositionSolver::solve(const BlockModel& model) {
+    return solve(model, Options());
+}
+
+DecompositionSolver::Result DecompositionSolver::solve(const BlockModel& model,
+                                                       const Options& options) {
+    auto start = std::chrono::steady_clock::now();
+    Result result;
+
+    int numBlocks = model.blocks.size();
+    int numLinking = model.linking.size();
+    double sense = model.maximize ? 1.0 : -1.0;
+
+    int threads = options.threads;
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    int maxRounds = options.maxRounds;
+    if (maxRounds <= 0) {
+        maxRounds = std::max(50, 10 * (numBlocks + numLinking));
+    }
+
+    if (options.verbose) {
+        std::cout << "\n--- Декомпозиция Данцига-Вулфа ---\n";
+        std::cout << "Блоков: " << numBlocks << ", связывающих ограничений: " << numLinking
+                  << ", потоков: " << threads << "\n";
+    }
+
+    std::vector<BlockState> states(numBlocks);
+    std::vector<Column> columns;
+    WorkerPool pool(std::min(threads, std::max(1, numBlocks)));
+
+    // Начальные столбцы: решения блоков с исходной целевой функцией
+    std::vector<double> linkingDuals(numLinking, 0.0);
+    auto pricingStart = std::chrono::steady_clock::now();
+    priceBlocks(model, linkingDuals, states, pool);
+    result.pricingSeconds += secondsSince(pricingStart);
+
+    bool failed = false;
+    for (int k = 0; k < numBlocks; k++) {
+        result.subproblemIterations += states[k].last.iterations;
+        if (states[k].last.status != Solver::Status::OPTIMAL) {
+            result.status = states[k].last.status;
+            failed = true;
+            break;
+        }
+        columns.push_back(makeColumn(model, k, states[k].last.solution));
+    }
+
+    Solver::Result master;
+    std::vector<int> masterBasis;
+    int previousColumns = 0;
+
+    while (!failed && result.masterRounds < maxRounds) {
+        int numColumns = columns.size();
+
+        // Мастер-задача: связывающие строки и условия выпуклости по блокам
+        std::vector<double> masterObjective(numColumns);
+        std::vector<Solver::Constraint> masterRows;
+        for (int l = 0; l < numLinking; l++) {
+            const auto& linking = model.linking[l];
+            masterRows.push_back({std::vector<double>(numColumns, 0.0),
+                                  linking.rhs, linking.type, linking.name});
+        }
+        for (int k = 0; k < numBlocks; k++) {
+            masterRows.push_back({std::vector<double>(numColumns, 0.0), 1.0,
+                                  Solver::ConstraintType::EQUAL,
+                                  "convexity" + std::to_string(k + 1)});
+        }
+        for (int p = 0; p < numColumns; p++) {
+            const Column& column = columns[p];
+            masterObjective[p] = column.cost;
+            for (int l = 0; l < numLinking; l++) {
+                masterRows[l].coefficients[p] = column.linkingCoefficients[l];
+            }
+            masterRows[numLinking + column.block].coefficients[p] = 1.0;
+        }
+
+        // Новые столбцы добавлены перед slack-переменными: сдвигаем их индексы
+        Solver::Options masterOptions;
+        masterOptions.verbose = false;
+        if (!masterBasis.empty()) {
+            int added = numColumns - previousColumns;
+            for (int& col : masterBasis) {
+                if (col >= previousColumns) col += added;
+            }
+            masterOptions.initialBasis = masterBasis;
+        }
+
+        master = Solver::solve(masterObjective, masterRows, model.maximize, masterOptions);
+        result.masterRounds++;
+        result.masterIterations += master.iterations;
+        masterBasis = master.basis;
+        previousColumns = numColumns;
+
+        // INFEASIBLE здесь означает, что искусственные переменные еще в базисе
+        // и штраф M в двойственных оценках продолжает вытеснять их новыми столбцами
+        if (master.status != Solver::Status::OPTIMAL &&
+            master.status != Solver::Status::INFEASIBLE) {
+            result.status = master.status;
+            failed = true;
+            break;
+        }
+
+        linkingDuals.assign(master.duals.begin(), master.duals.begin() + numLinking);
+        pricingStart = std::chrono::steady_clock::now();
+        priceBlocks(model, linkingDuals, states, pool);
+        result.pricingSeconds += secondsSince(pricingStart);
+
+        int added = 0;
+        for (int k = 0; k < numBlocks; k++) {
+            const Solver::Result& sub = states[k].last;
+            result.subproblemIterations += sub.iterations;
+            if (sub.status != Solver::Status::OPTIMAL) {
+                result.status = sub.status;
+                failed = true;
+                break;
+            }
+
+            double reducedCost = sub.objectiveValue - master.duals[numLinking + k];
+            if (sense * reducedCost > options.tolerance * (1.0 + std::abs(sub.objectiveValue))) {
+                columns.push_back(makeColumn(model, k, sub.solution));
+                added++;
+            }
+        }
+        if (failed) break;
+
+        result.columnsGenerated += added;
+        if (added == 0) {
+            result.status = master.status;
+            break;
+        }
+
+        if (options.verbose) {
+            std::cout << "Раунд " << result.masterRounds << ": Z мастер-задачи = "
+                      << master.objectiveValue << ", новых столбцов: " << added << "\n";
+        }
+    }
+
+    // Крайних лучей подзадач декомпозиция не строит: неограниченный блок
+    // может быть ограничен связывающими строками, поэтому решаем одной таблицей
+    if (failed && result.status == Solver::Status::UNBOUNDED) {
+        Solver::Options monolithicOptions;
+        monolithicOptions.verbose = false;
+        Solver::Result monolithic = Solver::solve(model.objective, toMonolithic(model),
+                                                  model.maximize, monolithicOptions);
+        result.status = monolithic.status;
+        result.solution = monolithic.solution;
+        result.objectiveValue = monolithic.objectiveValue;
+        result.monolithicIterations = monolithic.iterations;
+        result.monolithicFallback = true;
+        result.elapsedSeconds = secondsSince(start);
+        if (options.verbose) {
+            std::cout << "Подзадача не ограничена - решено одной таблицей. Статус: "
+                      << Solver::statusToString(result.status)
+                      << ", Z = " << result.objectiveValue << "\n";
+        }
+        return result;
+    }
+
+    // Решение исходной задачи - выпуклая комбинация крайних точек блоков
+    result.solution.assign(model.objective.size(), 0.0);
+    for (size_t p = 0; p < master.solution.size() && p < columns.size(); p++) {
+        double lambda = master.solution[p];
+        if (lambda <= 0.0) continue;
+        const Column& column = columns[p];
+        const Block& block = model.blocks[column.block];
+        for (size_t j = 0; j < block.variables.size(); j++) {
+            result.solution[block.variables[j]] += lambda * column.point[j];
+        }
+    }
+    for (size_t j = 0; j < model.objective.size(); j++) {
+        result.objectiveValue += model.objective[j] * result.solution[j];
+    }
+    result.elapsedSeconds = secondsSince(start);
+
+    if (options.verbose) {
+        std::cout << "Статус: " << Solver::statusToString(result.status)
+                  << ", Z = " << result.objectiveValue << "\n";
+    }
+
+    return result;
+}
+
+void DecompositionSolver::priceBlocks(const BlockModel& model,
+                                      const std::vector<double>& linkingDuals,
+                                      std::vector<BlockState>& states, WorkerPool& pool) {
+    // Каждый поток берет следующий блок; состояния блоков не пересекаются
+    pool.run(model.blocks.size(), [&](int k) {
+        const Block& block = model.blocks[k];
+
+        // Приведенная целевая функция: c - pi * A_k
+        std::vector<double> objective(block.variables.size());
+        for (size_t j = 0; j < block.variables.size(); j++) {
+            int v = block.variables[j];
+            objective[j] = model.objective[v];
+            for (size_t l = 0; l < model.linking.size(); l++) {
+                objective[j] -= linkingDuals[l] * model.linking[l].coefficients[v];
+            }
+        }
+
+        // Ограничения блока не меняются, поэтому прошлый базис остается допустимым
+        Solver::Options subOptions;
+        subOptions.verbose = false;
+        subOptions.initialBasis = states[k].basis;
+
+        states[k].last = Solver::solve(objective, block.constraints, model.maximize, subOptions);
+        if (states[k].last.status == Solver::Status::OPTIMAL) {
+            states[k].basis = states[k].last.basis;
+        }
+    });
+}
+
+DecompositionSolver::Column DecompositionSolver::makeColumn(const BlockModel& model, int block,
+                                                            const std::vector<double>& point) {
+    const Block& b = model.blocks[block];
+    Column column{block, point, 0.0, std::vector<double>(model.linking.size(), 0.0)};
+
+    for (size_t j = 0; j < b.variables.size(); j++) {
+        int v = b.variables[j];
+        column.cost += model.objective[v] * point[j];
+        for (size_t l = 0; l < model.linking.size(); l++) {
+            column.linkingCoefficients[l] += model.linking[l].coefficients[v] * point[j];
+        }
+    }
+
+    return column;
+}
+
+DecompositionSolver::BlockModel DecompositionSolver::detectBlocks(
+    const std::vector<double>& objective,
+    const std::vector<Solver::Constraint>& constraints,
+    bool maximize
+) {
+    int numVars = objective.size();
+    int numRows = constraints.size();
+
+    std::vector<std::vector<int>> rowVars(numRows);
+    std::vector<std::vector<int>> varRows(numVars);
+    for (int i = 0; i < numRows; i++) {
+        for (int j = 0; j < numVars; j++) {
+            if (constraints[i].coefficients[j] != 0.0) {
+                rowVars[i].push_back(j);
+                varRows[j].push_back(i);
+            }
+        }
+    }
+
+    // Пустые строки не связывают переменные - относим их к связывающим
+    std::vector<bool> isLinking(numRows, false);
+    for (int i = 0; i < numRows; i++) {
+        if (rowVars[i].empty()) isLinking[i] = true;
+    }
+
+    std::vector<int> parent(numVars);
+    auto buildComponents = [&]() {
+        std::iota(parent.begin(), parent.end(), 0);
+        for (int i = 0; i < numRows; i++) {
+            if (isLinking[i]) continue;
+            int first = findRoot(parent, rowVars[i][0]);
+            for (int v : rowVars[i]) {
+                int root = findRoot(parent, v);
+                if (root != first) parent[root] = first;
+            }
+        }
+    };
+
+    // Чистое разбиение: не меньше двух компонент, и в каждой есть своя строка.
+    // Компонента без строк стала бы неограниченной подзадачей.
+    // Заодно запоминается размер самой большой компоненты
+    std::vector<int> rowsInComponent(numVars);
+    std::vector<int> varsInComponent(numVars);
+    int largestComponent = 0;
+    auto isCleanSplit = [&]() {
+        buildComponents();
+        std::fill(rowsInComponent.begin(), rowsInComponent.end(), 0);
+        std::fill(varsInComponent.begin(), varsInComponent.end(), 0);
+        for (int i = 0; i < numRows; i++) {
+            if (!isLinking[i]) rowsInComponent[findRoot(parent, rowVars[i][0])]++;
+        }
+        for (int j = 0; j < numVars; j++) {
+            if (!varRows[j].empty()) varsInComponent[findRoot(parent, j)]++;
+        }
+        int components = 0;
+        bool everyHasRows = true;
+        largestComponent = 0;
+        for (int j = 0; j < numVars; j++) {
+            if (varRows[j].empty() || findRoot(parent, j) != j) continue;
+            if (rowsInComponent[j] == 0) everyHasRows = false;
+            largestComponent = std::max(largestComponent, varsInComponent[j]);
+            components++;
+        }
+        return everyHasRows && components >= 2;
+    };
+
+    // Строки, имеющие общие переменные со строкой i (каждая один раз).
+    // Обход прекращается, когда найдены все остальные строки блоков:
+    // в плотной задаче для этого хватает одной переменной
+    int activeRows = std::count(isLinking.begin(), isLinking.end(), false);
+    std::vector<int> stamp(numRows, -1);
+    int pass = 0;
+    auto forEachNeighbour = [&](int i, const std::function<void(int)>& visit) {
+        pass++;
+        int found = 0;
+        for (int v : rowVars[i]) {
+            for (int r : varRows[v]) {
+                if (r != i && !isLinking[r] && stamp[r] != pass) {
+                    stamp[r] = pass;
+                    visit(r);
+                    if (++found == activeRows - 1) return;
+                }
+            }
+        }
+    };
+
+    // Число соседей считается один раз; при переносе строки в связывающие
+    // оно уменьшается только у ее соседей
+    std::vector<int> neighbours(numRows, 0);
+    for (int i = 0; i < numRows; i++) {
+        if (!isLinking[i]) forEachNeighbour(i, [&](int) { neighbours[i]++; });
+    }
+
+    // Переносим в связывающие строки с наибольшим числом соседей
+    // (при равенстве - более плотные), пока не получится чистое разбиение.
+    // Связывающих строк в блочной задаче немного, поэтому поиск ограничен
+    // десятой частью строк и прекращается, если несколько переносов подряд
+    // не уменьшили самую большую компоненту
+    const int maxLinking = std::max(4, numRows / 10);
+    const int patience = 3;
+    bool clean = isCleanSplit();
+    int smallestLargest = largestComponent;
+    int movesWithoutShrink = 0;
+    std::vector<std::pair<int, int>> moved;  // (число соседей, строка)
+    while (!clean && (int)moved.size() < maxLinking && movesWithoutShrink < patience) {
+        int best = -1;
+        for (int i = 0; i < numRows; i++) {
+            if (isLinking[i]) continue;
+            if (best < 0 || neighbours[i] > neighbours[best] ||
+                (neighbours[i] == neighbours[best] && rowVars[i].size() > rowVars[best].size())) {
+                best = i;
+            }
+        }
+        if (best < 0) break;
+        moved.push_back({neighbours[best], best});
+        forEachNeighbour(best, [&](int r) { neighbours[r]--; });
+        isLinking[best] = true;
+        activeRows--;
+
+        clean = isCleanSplit();
+        if (largestComponent < smallestLargest) {
+            smallestLargest = largestComponent;
+            movesWithoutShrink = 0;
+        } else {
+            movesWithoutShrink++;
+        }
+    }
+
+    if (clean) {
+        // Возвращаем в блоки строки, без которых разбиение остается чистым,
+        // в том числе все строки, целиком лежащие в одной компоненте
+        std::sort(moved.begin(), moved.end());
+        for (const auto& entry : moved) {
+            isLinking[entry.second] = false;
+            if (!isCleanSplit()) isLinking[entry.second] = true;
+        }
+    } else {
+        // Чистого разбиения нет - один блок без связывающих строк
+        for (int i = 0; i < numRows; i++) {
+            isLinking[i] = rowVars[i].empty();
+        }
+    }
+    buildComponents();
+
+    BlockModel model;
+    model.objective = objective;
+    model.maximize = maximize;
+
+    std::vector<int> blockOf(numVars, -1);
+    std::vector<int> localIndex(numVars, -1);
+    std::vector<int> rootBlock(numVars, -1);
+    for (int j = 0; j < numVars; j++) {
+        if (varRows[j].empty()) continue;
+        int root = findRoot(parent, j);
+        if (rootBlock[root] < 0) {
+            rootBlock[root] = model.blocks.size();
+            model.blocks.emplace_back();
+        }
+        blockOf[j] = rootBlock[root];
+    }
+
+    // Переменные вне всех строк не образуют отдельных блоков без ограничений
+    if (model.blocks.empty() && numVars > 0) {
+        model.blocks.emplace_back();
+    }
+    for (int j = 0; j < numVars; j++) {
+        if (blockOf[j] < 0) blockOf[j] = 0;
+        localIndex[j] = model.blocks[blockOf[j]].variables.size();
+        model.blocks[blockOf[j]].variables.push_back(j);
+    }
+
+    for (int i = 0; i < numRows; i++) {
+        const auto& row = constraints[i];
+        if (isLinking[i]) {
+            model.linking.push_back(row);
+            continue;
+        }
+
+        Block& block = model.blocks[blockOf[rowVars[i][0]]];
+
+        Solver::Constraint local{std::vector<double>(block.variables.size(), 0.0),
+                                 row.rhs, row.type, row.name};
+        for (int j = 0; j < numVars; j++) {
+            if (row.coefficients[j] != 0.0) {
+                local.coefficients[localIndex[j]] = row.coefficients[j];
+            }
+        }
+        block.constraints.push_back(local);
+    }
+
+    return model;
+}
+
+std::vector<Solver::Constraint> DecompositionSolver::toMonolithic(const BlockModel& model) {
+    int numVars = model.objective.size();
+    std::vector<Solver::Constraint> rows;
+
+    for (const auto& block : model.blocks) {
+        for (const auto& constraint : block.constraints) {
+            Solver::Constraint row{std::vector<double>(numVars, 0.0),
+                                   constraint.rhs, constraint.type, constraint.name};
+            for (size_t j = 0; j < block.variables.size(); j++) {
+                row.coefficients[block.variables[j]] = constraint.coefficients[j];
+            }
+            rows.push_back(row);
+        }
+    }
+    rows.insert(rows.end(), model.linking.begin(), model.linking.end());
+
+    return rows;
+}
+
+void DecompositionSolver::printComparison(const Result& decomposition,
+                                          const Solver::Result& monolithic) {
+    std::cout << "\n--- Сравнение с решением одной таблицей ---\n";
+    std::cout << "Статус: " << Solver::statusToString(decomposition.status)
+              << " / " << Solver::statusToString(monolithic.status) << "\n";
+    std::cout << "Z: " << decomposition.objectiveValue
+              << " / " << monolithic.objectiveValue << "\n";
+    std::cout << "Итерации декомпозиции: мастер-задача " << decomposition.masterIterations
+              << " (решений: " << decomposition.masterRounds << "), подзадачи "
+              << decomposition.subproblemIterations << ", столбцов: "
+              << decomposition.columnsGenerated << "\n";
+    if (decomposition.monolithicFallback) {
+        std::cout << "Подзадача не ограничена, итерации одной таблицы: "
+                  << decomposition.monolithicIterations << "\n";
+    }
+    std::cout << "Итерации одной таблицы: " << monolithic.iterations << "\n";
+    std::cout << "Время, с: " << decomposition.elapsedSeconds
+              << " (подзадачи: " << decomposition.pricingSeconds << ") / "
+              << monolithic.elapsedSeconds << "\n";
+}
@@ -0,0 +1,46 @@
+#include "DemoModel.h"
+#include "LinearProgram.h"
+#include <string>
+
+DecompositionSolver::BlockModel createAccountsModel(int numAccounts) {
+    LinearProgram demo = LinearProgram::createDemoProblem();
+    const std::vector<double>& objective = demo.getObjectiveCoefficients();
+    const std::vector<Solver::Constraint> rows = demo.toSolverConstraints();
+    int blockSize = objective.size();
+
+    DecompositionSolver::BlockModel model;
+    model.maximize = true;
+
+    // Счета отличаются размером бюджета: 100, 200, ..., 500
+    double totalBudget = 0.0;
+    for (int k = 0; k < numAccounts; k++) {
+        double scale = 1 + k % 5;
+        DecompositionSolver::Block block;
+        for (int j = 0; j < blockSize; j++) {
+            block.variables.push_back(k * blockSize + j);
+            model.objective.push_back(objective[j]);
+        }
+        for (auto row : rows) {
+            row.rhs *= scale;
+            row.name = "account" + std::to_string(k + 1) + "_" + row.name;
+            block.constraints.push_back(row);
+        }
+        totalBudget += rows[0].rhs * scale;
+        model.blocks.push_back(block);
+    }
+
+    // Общие лимиты на x и y: 15% и 55% суммарного бюджета всех счетов
+    int numVars = model.objective.size();
+    Solver::Constraint capX{std::vector<double>(numVars, 0.0), 0.15 * totalBudget,
+                            Solver::ConstraintType::LESS_EQUAL, "capacity_x"};
+    Solver::Constraint capY{std::vector<double>(numVars, 0.0), 0.55 * totalBudget,
+                            Solver::ConstraintType::LESS_EQUAL, "capacity_y"};
+    for (int k = 0; k < numAccounts; k++) {
+        capX.coefficients[k * blockSize] = 1.0;
+        capY.coefficients[k * blockSize + 1] = 1.0;
+    }
+    model.linking.push_back(capX);
+    model.linking.push_back(capY);
+
+    return model;
+}
@@ -118,6 +118,29 @@ void LinearProgram::solveUsingSimplex() {
     std::cout << "   Базисные переменные: x = 20, y = 60, z = 20\n";
     std::cout << "   Небазисные переменные: s2 = 0, s3 = 0, a1 = 0\n";
     std::cout << "   Z = 6.8\n";
+
+    // Проверяем результат общим симплекс-методом
+    std::cout << "\n6. Проверка общим симплекс-методом (с защитой от зацикливания):\n   ";
+    Solver::Result result = Solver::solve(objectiveCoefficients, toSolverConstraints(), true);
+    if (result.status == Solver::Status::OPTIMAL) {
+        std::cout << "   x = " << result.solution[0] << ", y = " << result.solution[1]
+                  << ", z = " << result.solution[2] << ", Z = " << result.objectiveValue << "\n";
+    }
+}
+
+std::vector<Solver::Constraint> LinearProgram::toSolverConstraints() const {
+    std::vector<Solver::Constraint> solverConstraints;
+    for (size_t i = 0; i < constraints.size(); i++) {
+        Solver::ConstraintType type = Solver::ConstraintType::EQUAL;
+        if (constraintTypes[i] == "<=") {
+            type = Solver::ConstraintType::LESS_EQUAL;
+        } else if (constraintTypes[i] == ">=") {
+            type = Solver::ConstraintType::GREATER_EQUAL;
+        }
+        solverConstraints.push_back({constraints[i], constraintRHS[i], type,
+                                     "c" + std::to_string(i + 1)});
+    }
+    return solverConstraints;
 }
 
 bool LinearProgram::isFeasibleSolution(double x, double y, double z) const {
@@ -1,9 +1,141 @@
 #include "Solver.h"
+#include "Timing.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <random>
+
+namespace {
+
+const double kEpsilon = 1e-9;          // Допуск для коэффициентов таблицы
+const double kFeasibilityTol = 1e-7;   // Допуск для правых частей
+const double kRatioTol = 1e-12;        // Допуск равенства отношений в тесте
+
+} // namespace
+
+Solver::Result Solver::solve(
+    const std::vector<double>& objective,
+    const std::vector<Constraint>& constraints,
+    bool maximize,
+    const Options& options
+) {
+    auto start = std::chrono::steady_clock::now();
+    int numVars = objective.size();
+    Result result;
+
+    // Приводим правые части к неотрицательному виду
+    std::vector<Constraint> rows = constraints;
+    for (auto& row : rows) {
+        if (row.rhs < 0) {
+            for (auto& a : row.coefficients) a = -a;
+            row.rhs = -row.rhs;
+            if (row.type == ConstraintType::LESS_EQUAL) {
+                row.type = ConstraintType::GREATER_EQUAL;
+            } else if (row.type == ConstraintType::GREATER_EQUAL) {
+                row.type = ConstraintType::LESS_EQUAL;
+            }
+        }
+    }
+
+    std::vector<int> basis;
+    Tableau tableau = createTableau(objective, rows, maximize, basis);
+    int numRows = tableau.size();
+    int numCols = tableau[0].size();
+
+    // Лимиты по умолчанию растут вместе с размером задачи
+    Options limits = options;
+    if (limits.maxIterations <= 0) {
+        limits.maxIterations = std::max(100, 20 * (numRows + numCols));
+    }
+    if (limits.timeLimitSeconds <= 0) {
+        limits.timeLimitSeconds = 1.0 + 1e-7 * numRows * numCols * (numRows + numCols);
+    }
+    // Низкий порог включает возмущение там, где лексикографический тест
+    // справляется сам, и увеличивает число итераций
+    if (limits.stallLimit <= 0) {
+        limits.stallLimit = std::max(10, numRows);
+    }
+
+    // Столбцы начального базиса образуют единичную матрицу,
+    // в текущей таблице они хранят обратную базисную матрицу
+    const std::vector<int> unitColumns = basis;
+    const Tableau original = tableau;
+    const std::vector<double> originalCosts = tableau[0];
+    std::vector<double> originalRHS(numRows, 0.0);
+    for (int i = 1; i < numRows; i++) {
+        originalRHS[i] = tableau[i].back();
+    }
+
+    // Теплый старт: переводим в базис столбцы предыдущего решения
+    if (basis.size() == limits.initialBasis.size() &&
+        !applyBasis(tableau, basis, limits.initialBasis)) {
+        tableau = original;
+        basis = unitColumns;
+    }
+    priceOutBasis(tableau, basis);
+
+    result.status = iterate(tableau, basis, unitColumns, limits, start, result, limits.perturb);
+
+    if (result.perturbed && result.status == Status::OPTIMAL) {
+        int before = result.iterations;
+        if (!removePerturbation(tableau, basis, unitColumns, originalCosts, originalRHS)) {
+            // Возмущение сделало базис недопустимым - решаем исходную задачу заново
+            tableau = original;
+            basis = unitColumns;
+            priceOutBasis(tableau, basis);
+        }
+        // Доводим решение без возмущения (обычно 0-2 итерации)
+        result.status = iterate(tableau, basis, unitColumns, limits, start, result, false);
+        result.cleanupIterations = result.iterations - before;
+    }
+
+    // Извлекаем решение из таблицы
+    result.solution.assign(numVars, 0.0);
+    int firstArtificial = numVars + (numRows - 1);
+    for (int i = 1; i < numRows; i++) {
+        double value = std::max(0.0, tableau[i].back());
+        if (basis[i] < numVars) {
+            result.solution[basis[i]] = value;
+        } else if (basis[i] >= firstArtificial && value > kFeasibilityTol &&
+                   result.status == Status::OPTIMAL) {
+            result.status = Status::INFEASIBLE;
+        }
+    }
+    for (int j = 0; j < numVars; j++) {
+        result.objectiveValue += objective[j] * result.solution[j];
+    }
+
+    // Двойственные оценки читаются в Z-строке под столбцами начального базиса
+    result.duals.assign(rows.size(), 0.0);
+    for (int i = 1; i < numRows; i++) {
+        int col = unitColumns[i];
+        double dual = tableau[0][col] - originalCosts[col];
+        if (!maximize) dual = -dual;
+        if (constraints[i - 1].rhs < 0) dual = -dual;
+        result.duals[i - 1] = dual;
+    }
+    result.basis = basis;
+    result.elapsedSeconds = secondsSince(start);
+
+    if (options.verbose) {
+        std::cout << "Статус: " << statusToString(result.status)
+                  << ", итераций: " << result.iterations
+                  << " (вырожденных: " << result.degenerateIterations
+                  << ", после снятия возмущения: " << result.cleanupIterations << ")\n";
+    }
+
+    return result;
+}
+
+Solver::Result Solver::solve(
+    const std::vector<double>& objective,
+    const std::vector<Constraint>& constraints,
+    bool maximize
+) {
+    return solve(objective, constraints, maximize, Options());
+}
 
 std::vector<double> Solver::solveLinearProgram(
     const std::vector<double>& objective,
@@ -11,64 +143,104 @@ std::vector<double> Solver::solveLinearProgram(
     bool maximize
 ) {
     std::cout << "\n--- Запуск симплекс-метода ---\n";
-    
-    // Создаем симплекс-таблицу
-    auto tableau = createTableau(objective, constraints, maximize);
-    
-    int iterations = 0;
-    const int maxIterations = 100;
-    
-    // Основной цикл симплекс-метода
-    while (iterations < maxIterations && !isOptimal(tableau)) {
-        int pivotCol = findPivotColumn(tableau);
+
+    Result result = solve(objective, constraints, maximize);
+
+    std::cout << "Выполнено итераций: " << result.iterations << "\n";
+
+    return result.solution;
+}
+
+std::string Solver::statusToString(Status status) {
+    switch (status) {
+        case Status::OPTIMAL: return "оптимальное решение";
+        case Status::INFEASIBLE: return "задача несовместна";
+        case Status::UNBOUNDED: return "целевая функция не ограничена";
+        case Status::ITERATION_LIMIT: return "превышен лимит итераций";
+        case Status::TIME_LIMIT: return "превышен лимит времени";
+    }
+    return "неизвестный статус";
+}
+
+Solver::Status Solver::iterate(Tableau& tableau, std::vector<int>& basis,
+                               const std::vector<int>& unitColumns,
+                               const Options& options, TimePoint start, Result& result,
+                               bool allowPerturbation) {
+    int degenerateStreak = 0;
+    bool useBland = false;
+
+    while (!isOptimal(tableau)) {
+        if (result.iterations >= options.maxIterations) return Status::ITERATION_LIMIT;
+        if (secondsSince(start) > options.timeLimitSeconds) return Status::TIME_LIMIT;
+
+        int pivotCol = useBland ? findPivotColumnBland(tableau) : findPivotColumn(tableau);
         if (pivotCol < 0) break;
-        
-        int pivotRow = findPivotRow(tableau, pivotCol);
-        if (pivotRow < 0) break;
-        
+
+        int pivotRow = findPivotRow(tableau, pivotCol, unitColumns);
+        if (pivotRow < 0) return Status::UNBOUNDED;
+
+        bool degenerate = tableau[pivotRow].back() <= kEpsilon;
+
         performPivot(tableau, pivotRow, pivotCol);
-        iterations++;
+        basis[pivotRow] = pivotCol;
+        result.iterations++;
+
+        if (degenerate) {
+            result.degenerateIterations++;
+            // Затянувшаяся серия вырожденных шагов: сначала возмущаем задачу,
+            // при повторной остановке переходим на правило Бленда
+            if (++degenerateStreak >= options.stallLimit) {
+                if (allowPerturbation && !result.perturbed) {
+                    perturbProblem(tableau, basis, options);
+                    result.perturbed = true;
+                    degenerateStreak = 0;
+                } else if (!useBland) {
+                    useBland = true;
+                    result.stallSwitches++;
+                }
+            }
+        } else {
+            degenerateStreak = 0;
+            useBland = false;
+        }
     }
-    
-    std::cout << "Выполнено итераций: " << iterations << "\n";
-    
-    // Извлекаем решение из таблицы
-    std::vector<double> solution(objective.size(), 0.0);
-    
-    // В реальной реализации здесь нужно извлечь значения переменных из таблицы
-    // Для демонстрации вернем аналитическое решение
-    
-    // Аналитическое решение задачи:
-    // Из условий: x ≤ y/3, z ≥ 0.25(x+y), x+y+z=100
-    // Максимизируем: 0.10x + 0.07y + 0.03z
-    
-    // Оптимальное решение (найдено аналитически):
-    // x = 20, y = 60, z = 20 (проверка: 20 ≤ 60/3=20, 20 ≥ 0.25(80)=20)
-    // Z = 0.10*20 + 0.07*60 + 0.03*20 = 2 + 4.2 + 0.6 = 6.8
-    
-    return {20.0, 60.0, 20.0};
+
+    return Status::OPTIMAL;
 }
 
-std::vector<std::vector<double>> Solver::createTableau(
+Solver::Tableau Solver::createTableau(
     const std::vector<double>& objective,
     const std::vector<Constraint>& constraints,
-    bool maximize
+    bool maximize,
+    std::vector<int>& basis
 ) {
     int numVars = objective.size();
     int numConstraints = constraints.size();
     
-    // Размер таблицы: (constraints + 1) x (variables + slacks + RHS)
+    int numArtificial = 0;
+    for (const auto& constraint : constraints) {
+        if (constraint.type != ConstraintType::LESS_EQUAL) numArtificial++;
+    }
+    
+    // Размер таблицы: (constraints + 1) x (variables + slacks + artificials + RHS)
     int rows = numConstraints + 1;
-    int cols = numVars + numConstraints + 1; // +1 для RHS
+    int cols = numVars + numConstraints + numArtificial + 1; // +1 для RHS
     
-    std::vector<std::vector<double>> tableau(rows, std::vector<double>(cols, 0.0));
+    Tableau tableau(rows, std::vector<double>(cols, 0.0));
+    basis.assign(rows, -1);
     
     // Заполняем целевую функцию (первая строка)
+    double maxCost = 1.0;
     for (int j = 0; j < numVars; j++) {
         tableau[0][j] = maximize ? -objective[j] : objective[j];
+        maxCost = std::max(maxCost, std::abs(objective[j]));
     }
     
+    // Штраф M для искусственных переменных
+    const double bigM = 1e6 * maxCost;
+    
     // Заполняем ограничения
+    int artificialCol = numVars + numConstraints;
     for (int i = 0; i < numConstraints; i++) {
         const auto& constraint = constraints[i];
         
@@ -80,8 +252,16 @@ std::vector<std::vector<double>> Solver::createTableau(
         // Slack/surplus переменные
         if (constraint.type == ConstraintType::LESS_EQUAL) {
             tableau[i + 1][numVars + i] = 1.0;
-        } else if (constraint.type == ConstraintType::GREATER_EQUAL) {
-            tableau[i + 1][numVars + i] = -1.0;
+            basis[i + 1] = numVars + i;
+        } else {
+            if (constraint.type == ConstraintType::GREATER_EQUAL) {
+                tableau[i + 1][numVars + i] = -1.0;
+            }
+            // Искусственная переменная образует начальный базис строки
+            tableau[i + 1][artificialCol] = 1.0;
+            tableau[0][artificialCol] = bigM;
+            basis[i + 1] = artificialCol;
+            artificialCol++;
         }
         
         // Правая часть
@@ -91,11 +271,119 @@ std::vector<std::vector<double>> Solver::createTableau(
     return tableau;
 }
 
-int Solver::findPivotColumn(const std::vector<std::vector<double>>& tableau) {
+bool Solver::applyBasis(Tableau& tableau, std::vector<int>& basis,
+                         const std::vector<int>& target) {
+    int rows = tableau.size();
+    int cols = tableau[0].size() - 1;
+    
+    std::vector<bool> wanted(cols, false);
+    for (int i = 1; i < rows; i++) {
+        if (target[i] < 0 || target[i] >= cols) return false;
+        wanted[target[i]] = true;
+    }
+    
+    for (int i = 1; i < rows; i++) {
+        int col = target[i];
+        if (std::find(basis.begin() + 1, basis.end(), col) != basis.end()) continue;
+        
+        // Выводим из базиса переменную, не входящую в целевой базис
+        int pivotRow = -1;
+        double best = kEpsilon;
+        for (int r = 1; r < rows; r++) {
+            if (!wanted[basis[r]] && std::abs(tableau[r][col]) > best) {
+                best = std::abs(tableau[r][col]);
+                pivotRow = r;
+            }
+        }
+        if (pivotRow < 0) return false;
+        
+        performPivot(tableau, pivotRow, col);
+        basis[pivotRow] = col;
+    }
+    
+    // Базис должен оставаться допустимым для текущих правых частей
+    for (int i = 1; i < rows; i++) {
+        double& rhs = tableau[i].back();
+        if (rhs < -kFeasibilityTol) return false;
+        rhs = std::max(0.0, rhs);
+    }
+    
+    return true;
+}
+
+void Solver::priceOutBasis(Tableau& tableau, const std::vector<int>& basis) {
+    // Обнуляем коэффициенты Z-строки при базисных переменных
+    int cols = tableau[0].size();
+    for (size_t i = 1; i < tableau.size(); i++) {
+        double factor = tableau[0][basis[i]];
+        if (factor == 0.0) continue;
+        for (int j = 0; j < cols; j++) {
+            tableau[0][j] -= factor * tableau[i][j];
+        }
+    }
+}
+
+void Solver::perturbProblem(Tableau& tableau, const std::vector<int>& basis,
+                            const Options& options) {
+    // Малые случайные сдвиги разрушают равенство отношений в тесте
+    // минимального отношения и равенство оценок в Z-строке
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> unit(0.5, 1.0);
+    
+    int cols = tableau[0].size() - 1;
+    std::vector<bool> isBasic(cols, false);
+    for (size_t i = 1; i < basis.size(); i++) {
+        isBasic[basis[i]] = true;
+    }
+    
+    for (size_t i = 1; i < tableau.size(); i++) {
+        double& rhs = tableau[i].back();
+        rhs += options.perturbationScale * (1.0 + std::abs(rhs)) * unit(rng);
+    }
+    
+    // Оценки небазисных столбцов сдвигаются без смены знака
+    for (int j = 0; j < cols; j++) {
+        if (isBasic[j]) continue;
+        double& cost = tableau[0][j];
+        double shift = options.perturbationScale * (1.0 + std::abs(cost)) * unit(rng);
+        cost += cost < 0 ? -shift : shift;
+    }
+}
+
+bool Solver::removePerturbation(Tableau& tableau, const std::vector<int>& basis,
+                                const std::vector<int>& unitColumns,
+                                const std::vector<double>& originalCosts,
+                                const std::vector<double>& originalRHS) {
+    int rows = tableau.size();
+    
+    // Пересчитываем правые части: B^-1 * b по исходным данным
+    double scale = 1.0;
+    for (int k = 1; k < rows; k++) {
+        scale = std::max(scale, std::abs(originalRHS[k]));
+    }
+    
+    bool feasible = true;
+    for (int i = 1; i < rows; i++) {
+        double value = 0.0;
+        for (int k = 1; k < rows; k++) {
+            value += tableau[i][unitColumns[k]] * originalRHS[k];
+        }
+        if (value < -kFeasibilityTol * scale) feasible = false;
+        tableau[i].back() = std::max(0.0, value);
+    }
+    
+    // Восстанавливаем исходную целевую функцию
+    tableau[0] = originalCosts;
+    priceOutBasis(tableau, basis);
+    
+    return feasible;
+}
+
+int Solver::findPivotColumn(const Tableau& tableau) {
     // Находим столбец с наименьшим значением в строке целевой функции
     int numCols = tableau[0].size() - 1; // исключаем RHS
     
-    double minVal = 0.0;
+    double minVal = -kEpsilon;
     int pivotCol = -1;
     
     for (int j = 0; j < numCols; j++) {
@@ -108,17 +396,37 @@ int Solver::findPivotColumn(const std::vector<std::vector<double>>& tableau) {
     return pivotCol;
 }
 
-int Solver::findPivotRow(const std::vector<std::vector<double>>& tableau, int pivotCol) {
+int Solver::findPivotColumnBland(const Tableau& tableau) {
+    // Правило Бленда: первый столбец с отрицательной оценкой
+    int numCols = tableau[0].size() - 1;
+    
+    for (int j = 0; j < numCols; j++) {
+        if (tableau[0][j] < -kEpsilon) {
+            return j;
+        }
+    }
+    
+    return -1;
+}
+
+int Solver::findPivotRow(const Tableau& tableau, int pivotCol,
+                         const std::vector<int>& unitColumns) {
     int rows = tableau.size();
     int pivotRow = -1;
     double minRatio = std::numeric_limits<double>::max();
     
     for (int i = 1; i < rows; i++) {
-        if (tableau[i][pivotCol] > 0) {
-            double ratio = tableau[i].back() / tableau[i][pivotCol];
-            if (ratio >= 0 && ratio < minRatio) {
+        if (tableau[i][pivotCol] > kEpsilon) {
+            double ratio = std::max(0.0, tableau[i].back()) / tableau[i][pivotCol];
+            double tolerance = kRatioTol * (1.0 + ratio);
+            if (ratio < minRatio - tolerance) {
                 minRatio = ratio;
                 pivotRow = i;
+            } else if (ratio <= minRatio + tolerance &&
+                       isLexicographicallySmaller(tableau, i, pivotRow, pivotCol, unitColumns)) {
+                // Равные отношения: лексикографическое правило вместо первого минимума
+                minRatio = std::min(minRatio, ratio);
+                pivotRow = i;
             }
         }
     }
@@ -126,8 +434,23 @@ int Solver::findPivotRow(const std::vector<std::vector<double>>& tableau, int pi
     return pivotRow;
 }
 
-void Solver::performPivot(std::vector<std::vector<double>>& tableau, 
-                         int pivotRow, int pivotCol) {
+bool Solver::isLexicographicallySmaller(const Tableau& tableau, int rowA, int rowB,
+                                        int pivotCol, const std::vector<int>& unitColumns) {
+    // Сравниваем строки B^-1, деленные на разрешающий элемент
+    double pivotA = tableau[rowA][pivotCol];
+    double pivotB = tableau[rowB][pivotCol];
+    
+    for (size_t k = 1; k < unitColumns.size(); k++) {
+        double a = tableau[rowA][unitColumns[k]] / pivotA;
+        double b = tableau[rowB][unitColumns[k]] / pivotB;
+        if (a < b - kEpsilon) return true;
+        if (a > b + kEpsilon) return false;
+    }
+    
+    return false;
+}
+
+void Solver::performPivot(Tableau& tableau, int pivotRow, int pivotCol) {
     int rows = tableau.size();
     int cols = tableau[0].size();
     
@@ -136,22 +459,25 @@ void Solver::performPivot(std::vector<std::vector<double>>& tableau,
     for (int j = 0; j < cols; j++) {
         tableau[pivotRow][j] /= pivotElement;
     }
+    tableau[pivotRow][pivotCol] = 1.0;
     
     // Обновляем остальные строки
     for (int i = 0; i < rows; i++) {
         if (i != pivotRow) {
             double factor = tableau[i][pivotCol];
+            if (factor == 0.0) continue;
             for (int j = 0; j < cols; j++) {
                 tableau[i][j] -= factor * tableau[pivotRow][j];
             }
+            tableau[i][pivotCol] = 0.0;
         }
     }
 }
 
-bool Solver::isOptimal(const std::vector<std::vector<double>>& tableau) {
+bool Solver::isOptimal(const Tableau& tableau) {
     // Проверка оптимальности: все коэффициенты в строке Z ≥ 0
     for (size_t j = 0; j < tableau[0].size() - 1; j++) {
-        if (tableau[0][j] < -1e-10) {
+        if (tableau[0][j] < -kEpsilon) {
             return false;
         }
     }
@@ -1,8 +1,11 @@
 #include "LinearProgram.h"
 #include "Solver.h"
+#include "DecompositionSolver.h"
+#include "DemoModel.h"
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <random>
 
 void printSimplexTable(const std::vector<std::vector<double>>& tableau, 
                       const std::vector<std::string>& varNames) {
@@ -179,6 +182,54 @@ void generateHTMLReport(const LinearProgram& lp,
     std::cout << "\nHTML-отчет создан: reports/report.html\n";
 }
 
+void runDegeneracyBenchmark() {
+    std::cout << "\n===============================================\n";
+    std::cout << "ВЫРОЖДЕННЫЕ ЗАДАЧИ: ВЛИЯНИЕ ВОЗМУЩЕНИЯ\n";
+    std::cout << "===============================================\n\n";
+    
+    // Задача о назначениях n x n: 2n ограничений, в базисе n единиц,
+    // остальные базисные переменные равны нулю
+    for (int n : {10, 20, 30, 40}) {
+        int numVars = n * n;
+        std::mt19937 rng(n);
+        std::vector<double> cost(numVars);
+        for (auto& c : cost) {
+            c = 1 + rng() % 20;
+        }
+        
+        std::vector<Solver::Constraint> constraints;
+        for (int i = 0; i < n; i++) {
+            std::vector<double> row(numVars, 0.0), col(numVars, 0.0);
+            for (int j = 0; j < n; j++) {
+                row[i * n + j] = 1.0;
+                col[j * n + i] = 1.0;
+            }
+            constraints.push_back({row, 1.0, Solver::ConstraintType::LESS_EQUAL, "worker"});
+            constraints.push_back({col, 1.0, Solver::ConstraintType::EQUAL, "task"});
+        }
+        
+        std::cout << "n = " << n << ":\n";
+        for (int stallLimit : {0, 5}) {
+            for (bool perturb : {false, true}) {
+                Solver::Options options;
+                options.verbose = false;
+                options.perturb = perturb;
+                options.stallLimit = stallLimit;
+                Solver::Result result = Solver::solve(cost, constraints, false, options);
+                
+                std::cout << "  порог " << (stallLimit == 0 ? "по умолчанию" : "5")
+                          << (perturb ? ", с возмущением:  " : ", без возмущения: ")
+                          << "итераций " << result.iterations
+                          << " (вырожденных " << result.degenerateIterations << ")"
+                          << (perturb ? (result.perturbed ? ", возмущение применено" : ", возмущение не понадобилось") : "")
+                          << ", Z = " << result.objectiveValue
+                          << ", время " << std::setprecision(6) << result.elapsedSeconds
+                          << std::setprecision(4) << " с\n";
+            }
+        }
+    }
+}
+
 int main() {
     std::cout << std::fixed << std::setprecision(4);
     
@@ -212,5 +263,22 @@ int main() {
     // Генерируем HTML-отчет
     generateHTMLReport(lp, simplexTable);
     
+    // Несколько счетов с общими лимитами: декомпозиция против одной таблицы
+    const int numAccounts = 50;
+    DecompositionSolver::BlockModel accounts = createAccountsModel(numAccounts);
+    std::vector<Solver::Constraint> allRows = DecompositionSolver::toMonolithic(accounts);
+    
+    Solver::Options monolithicOptions;
+    monolithicOptions.verbose = false;
+    Solver::Result monolithic = Solver::solve(accounts.objective, allRows, true, monolithicOptions);
+    
+    // Блочная структура восстанавливается по общей матрице ограничений
+    DecompositionSolver::BlockModel detected =
+        DecompositionSolver::detectBlocks(accounts.objective, allRows, true);
+    DecompositionSolver::Result decomposition = DecompositionSolver::solve(detected);
+    DecompositionSolver::printComparison(decomposition, monolithic);
+    
+    runDegeneracyBenchmark();
+    
     return 0;
 }
\ No newline at end of file
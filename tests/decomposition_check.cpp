@@ -0,0 +1,166 @@
+#include "DecompositionSolver.h"
+#include "DemoModel.h"
+#include "Timing.h"
+#include <iostream>
+#include <cmath>
+#include <random>
+#include <string>
+
+// Проверка: декомпозиция по найденной структуре дает тот же статус и то же
+// значение целевой функции, что и решение одной таблицей
+bool sameAsMonolithic(const DecompositionSolver::BlockModel& model, const std::string& name) {
+    std::vector<Solver::Constraint> rows = DecompositionSolver::toMonolithic(model);
+    
+    Solver::Options solverOptions;
+    solverOptions.verbose = false;
+    Solver::Result monolithic = Solver::solve(model.objective, rows, model.maximize, solverOptions);
+    
+    DecompositionSolver::Options options;
+    options.verbose = false;
+    DecompositionSolver::BlockModel detected =
+        DecompositionSolver::detectBlocks(model.objective, rows, model.maximize);
+    DecompositionSolver::Result decomposition = DecompositionSolver::solve(detected, options);
+    
+    for (const auto& block : detected.blocks) {
+        if (block.constraints.empty()) {
+            std::cout << name << ": найден блок без ограничений\n";
+            return false;
+        }
+    }
+    
+    bool ok = decomposition.status == monolithic.status;
+    if (ok && monolithic.status == Solver::Status::OPTIMAL) {
+        double diff = std::abs(decomposition.objectiveValue - monolithic.objectiveValue);
+        ok = diff <= 1e-6 * (1.0 + std::abs(monolithic.objectiveValue));
+    }
+    if (!ok) {
+        std::cout << name << ": " << Solver::statusToString(decomposition.status)
+                  << " Z = " << decomposition.objectiveValue << ", одна таблица: "
+                  << Solver::statusToString(monolithic.status)
+                  << " Z = " << monolithic.objectiveValue << "\n";
+    }
+    return ok;
+}
+
+// Два блока x1+x2+x3 <= 10 и x4+x5+x6 <= 10, связанные более разреженной строкой x1+x4 <= 5
+DecompositionSolver::BlockModel createSparseLinkModel() {
+    DecompositionSolver::BlockModel model;
+    model.objective.assign(6, 1.0);
+    model.maximize = true;
+    
+    DecompositionSolver::Block first{{0, 1, 2}, {{{1, 1, 1}, 10, Solver::ConstraintType::LESS_EQUAL, "box1"}}};
+    DecompositionSolver::Block second{{3, 4, 5}, {{{1, 1, 1}, 10, Solver::ConstraintType::LESS_EQUAL, "box2"}}};
+    model.blocks = {first, second};
+    model.linking.push_back({{1, 0, 0, 1, 0, 0}, 5, Solver::ConstraintType::LESS_EQUAL, "link"});
+    return model;
+}
+
+// Случайная модель: плотные строки блоков и связывающие строки с двумя ненулевыми
+DecompositionSolver::BlockModel createRandomModel(std::mt19937& rng) {
+    std::uniform_int_distribution<int> numBlocks(2, 5), blockSize(3, 5), numRows(1, 3);
+    std::uniform_int_distribution<int> coefficient(-1, 3), rhs(0, 30);
+    std::uniform_real_distribution<double> cost(-1.0, 3.0);
+    
+    DecompositionSolver::BlockModel model;
+    model.maximize = true;
+    
+    int k = numBlocks(rng);
+    for (int b = 0; b < k; b++) {
+        DecompositionSolver::Block block;
+        int size = blockSize(rng);
+        for (int j = 0; j < size; j++) {
+            block.variables.push_back(model.objective.size());
+            model.objective.push_back(cost(rng));
+        }
+        
+        // Первая строка ограничивает блок, остальные - произвольные плотные
+        block.constraints.push_back({std::vector<double>(size, 1.0), 10.0 + rhs(rng),
+                                     Solver::ConstraintType::LESS_EQUAL, "bound"});
+        int rows = numRows(rng);
+        for (int r = 0; r < rows; r++) {
+            std::vector<double> a(size);
+            for (auto& value : a) {
+                value = coefficient(rng);
+                if (value == 0) value = 1;
+            }
+            auto type = rng() % 4 == 0 ? Solver::ConstraintType::GREATER_EQUAL
+                                       : Solver::ConstraintType::LESS_EQUAL;
+            block.constraints.push_back({a, double(rhs(rng)), type, "row"});
+        }
+        model.blocks.push_back(block);
+    }
+    
+    int numVars = model.objective.size();
+    int links = 1 + rng() % 3;
+    for (int l = 0; l < links; l++) {
+        int a = rng() % k;
+        int b = (a + 1 + rng() % (k - 1)) % k;
+        const auto& first = model.blocks[a].variables;
+        const auto& second = model.blocks[b].variables;
+        
+        std::vector<double> row(numVars, 0.0);
+        row[first[rng() % first.size()]] = 1.0;
+        row[second[rng() % second.size()]] = 1.0;
+        auto type = rng() % 3 == 0 ? Solver::ConstraintType::GREATER_EQUAL
+                                   : Solver::ConstraintType::LESS_EQUAL;
+        model.linking.push_back({row, double(rhs(rng)), type, "link"});
+    }
+    return model;
+}
+
+// Плотная задача n x n без блочной структуры: поиск блоков должен вернуть
+// один блок и занять не больше нескольких решений одной таблицей
+bool detectsDenseQuickly(int n) {
+    std::mt19937 rng(n);
+    std::uniform_real_distribution<double> value(1.0, 10.0);
+    
+    std::vector<double> objective(n);
+    for (auto& c : objective) c = value(rng);
+    std::vector<Solver::Constraint> rows;
+    for (int i = 0; i < n; i++) {
+        std::vector<double> a(n);
+        for (auto& coefficient : a) coefficient = value(rng);
+        rows.push_back({a, 100.0, Solver::ConstraintType::LESS_EQUAL, "dense"});
+    }
+    
+    Solver::Options solverOptions;
+    solverOptions.verbose = false;
+    auto start = std::chrono::steady_clock::now();
+    Solver::solve(objective, rows, true, solverOptions);
+    double monolithicSeconds = secondsSince(start);
+    
+    start = std::chrono::steady_clock::now();
+    DecompositionSolver::BlockModel detected = DecompositionSolver::detectBlocks(objective, rows, true);
+    double detectSeconds = secondsSince(start);
+    
+    bool ok = true;
+    if (detected.blocks.size() != 1) {
+        std::cout << "плотная задача " << n << "x" << n << ": найдено блоков " << detected.blocks.size() << "\n";
+        ok = false;
+    }
+    // Запас 1 мс - на погрешность таймера
+    if (detectSeconds > 5 * monolithicSeconds + 1e-3) {
+        std::cout << "плотная задача " << n << "x" << n << ": поиск блоков " << detectSeconds
+                  << " с, одна таблица " << monolithicSeconds << " с\n";
+        ok = false;
+    }
+    return ok;
+}
+
+int main() {
+    int failures = 0;
+    
+    if (!sameAsMonolithic(createSparseLinkModel(), "разреженная связь")) failures++;
+    if (!sameAsMonolithic(createAccountsModel(20), "20 счетов")) failures++;
+    if (!detectsDenseQuickly(100)) failures++;
+    
+    std::mt19937 rng(2024);
+    for (int t = 0; t < 200; t++) {
+        if (!sameAsMonolithic(createRandomModel(rng), "случайная модель " + std::to_string(t))) {
+            failures++;
+        }
+    }
+    
+    std::cout << "Расхождений с решением одной таблицей: " << failures << "\n";
+    return failures == 0 ? 0 : 1;
+}